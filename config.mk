@@ -0,0 +1,8 @@
+CXX             := mpic++
+CC              := gcc
+CXXFLAGS        := -O1 -Wall
+CXXFLAGS        += -std=c++17
+PARALLEL_MODE   := MPI
+PLATFORMS       := CPU_SISD
+FLOATING_POINT_TYPE := double
+USE_EMBEDDED_DEPENDENCIES := ON
@@ -0,0 +1,38 @@
+# Example build config for OpenLB using GNU C++ and OpenMPI on heterogeneous clusters
+#
+# Usage:
+#  - Copy this file to OpenLB root as `config.mk`
+#  - Run `make clean; make`
+#  - Switch to example directory, e.g. `examples/laminar/cavity3dBenchmark`
+#  - Run `make`
+#  - Start the simulation using `mpirun ./cavity3d`
+#
+# The example is compiled once per instruction set listed in `SIMD_ISAS`
+# (e.g. `cavity3d.avx2`, `cavity3d.avx512`). The `cavity3d` executable is a
+# small launcher selecting the best supported variant on each node at startup.
+# The selected kernels are reported by `olbInit`.
+
+CXX             := mpic++
+CC              := gcc
+
+# Do not add `-march` flags here as they would apply to all variants
+CXXFLAGS        := -O3 -Wall -mtune=generic
+CXXFLAGS        += -std=c++17
+
+PARALLEL_MODE   := MPI
+
+# optional MPI and OpenMP flags
+OMPFLAGS        := -fopenmp
+
+PLATFORMS       := CPU_SISD CPU_SIMD
+
+# Instruction sets to build executable variants for
+SIMD_ISAS       := avx2 avx512
+
+# Per-variant flags may be customized, e.g. to target specific microarchitectures
+#SIMD_FLAGS_avx2   := -march=haswell
+#SIMD_FLAGS_avx512 := -march=skylake-avx512
+
+FLOATING_POINT_TYPE := double
+
+USE_EMBEDDED_DEPENDENCIES := ON
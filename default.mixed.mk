@@ -36,7 +36,17 @@ INCLUDE_FLAGS := -I$(subst $(EMPTY) $(EMPTY), -I,$(INCLUDE_DIRS))
 %.o: %.cpp
 	$(CXX) $(CXXFLAGS) $(INCLUDE_FLAGS) -c -o $@ $<
 
-build/missing.txt: $(OBJ_FILES)
+ifneq ($(and $(SIMD_ISAS),$(filter CPU_SIMD,$(PLATFORMS))),)
+# Compile one executable variant per instruction set and select at startup
+SIMD_VARIANTS := $(SIMD_ISAS:%=$(EXAMPLE).%)
+SIMD_OBJ_FILES := $(foreach isa,$(SIMD_ISAS),$(CPP_FILES:.cpp=.$(isa).o))
+# Vectorized code requires instruction set flags, all variants need the same instantiations
+MISSING_OBJ_FILES := $(CPP_FILES:.cpp=.$(firstword $(SIMD_ISAS)).o)
+else
+MISSING_OBJ_FILES := $(OBJ_FILES)
+endif
+
+build/missing.txt: $(MISSING_OBJ_FILES)
 	mkdir -p build
 	$(CXX) $^ $(LDFLAGS) -lolbcore 2>&1 | grep -oP ".*undefined reference to \`\K[^']+\)" | sort | uniq > $@
 
@@ -107,8 +117,22 @@ build/olbcuda.version: $(CUDA_OBJ_FILES)
 libolbcuda.so: $(CUDA_OBJ_FILES) build/olbcuda.version
 	$(CUDA_CXX) $(CUDA_CXXFLAGS) -Xlinker --version-script=build/olbcuda.version -shared $(CUDA_OBJ_FILES) -o $@
 
+ifneq ($(SIMD_VARIANTS),)
+define SIMD_VARIANT_RULES
+%.$(1).o: %.cpp
+	$$(CXX) $$(CXXFLAGS) $$(SIMD_FLAGS_$(1)) $$(INCLUDE_FLAGS) -c -o $$@ $$<
+
+$(EXAMPLE).$(1): $(CPP_FILES:.cpp=.$(1).o) libolbcuda.so
+	$$(CXX) $(CPP_FILES:.cpp=.$(1).o) -o $$@ $$(LDFLAGS) -L . -lolbcuda -lolbcore $$(CUDA_LDFLAGS)
+endef
+$(foreach isa,$(SIMD_ISAS),$(eval $(call SIMD_VARIANT_RULES,$(isa))))
+
+$(EXAMPLE): $(SIMD_VARIANTS)
+	$(CXX) -std=c++17 -O2 -o $@ $(OLB_ROOT)/src/core/platform/cpu/simd/launcher.cpp
+else
 $(EXAMPLE): $(OBJ_FILES) libolbcuda.so
 	$(CXX) $(OBJ_FILES) -o $@ $(LDFLAGS) -L . -lolbcuda -lolbcore $(CUDA_LDFLAGS)
+endif
 
 $(EXAMPLE)-no-cuda-recompile: $(OBJ_FILES)
 	$(CXX) $^ -o $(EXAMPLE) $(LDFLAGS) -L . -lolbcuda -lolbcore $(CUDA_LDFLAGS)
@@ -129,6 +153,6 @@ clean-core:
 
 .PHONY: clean
 clean: clean-tmp
-	rm -f $(OBJ_FILES) $(DEP_FILES) $(EXAMPLE) $(CUDA_OBJ_FILES) $(CUDA_CPP_FILES) libolbcuda.so
+	rm -f $(OBJ_FILES) $(DEP_FILES) $(EXAMPLE) $(SIMD_OBJ_FILES) $(SIMD_VARIANTS) $(CUDA_OBJ_FILES) $(CUDA_CPP_FILES) libolbcuda.so
 
 -include $(DEP_FILES)
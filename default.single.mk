@@ -34,8 +34,26 @@ INCLUDE_FLAGS := -I$(subst $(EMPTY) $(EMPTY), -I,$(INCLUDE_DIRS))
 %.o: %.cpp
 	$(CXX) $(CXXFLAGS) $(INCLUDE_FLAGS) -c -o $@ $<
 
+ifneq ($(and $(SIMD_ISAS),$(filter CPU_SIMD,$(PLATFORMS))),)
+# Compile one executable variant per instruction set and select at startup
+SIMD_VARIANTS := $(SIMD_ISAS:%=$(EXAMPLE).%)
+SIMD_OBJ_FILES := $(foreach isa,$(SIMD_ISAS),$(CPP_FILES:.cpp=.$(isa).o))
+
+define SIMD_VARIANT_RULES
+%.$(1).o: %.cpp
+	$$(CXX) $$(CXXFLAGS) $$(SIMD_FLAGS_$(1)) $$(INCLUDE_FLAGS) -c -o $$@ $$<
+
+$(EXAMPLE).$(1): $(CPP_FILES:.cpp=.$(1).o)
+	$$(CXX) $$^ -o $$@ -lolbcore $$(LDFLAGS)
+endef
+$(foreach isa,$(SIMD_ISAS),$(eval $(call SIMD_VARIANT_RULES,$(isa))))
+
+$(EXAMPLE): $(SIMD_VARIANTS)
+	$(CXX) -std=c++17 -O2 -o $@ $(OLB_ROOT)/src/core/platform/cpu/simd/launcher.cpp
+else
 $(EXAMPLE): $(OBJ_FILES)
 	$(CXX) $(OBJ_FILES) -o $@ -lolbcore $(LDFLAGS)
+endif
 
 .PHONY: onlysample
 onlysample: $(EXAMPLE)
@@ -50,6 +68,6 @@ clean-core:
 
 .PHONY: clean
 clean: clean-tmp
-	rm -f $(OBJ_FILES) $(DEP_FILES) $(EXAMPLE)
+	rm -f $(OBJ_FILES) $(DEP_FILES) $(EXAMPLE) $(SIMD_OBJ_FILES) $(SIMD_VARIANTS)
 
 -include $(DEP_FILES)